@@ -17,6 +17,8 @@
 #include <natus/device/global.h>
 
 #include <thread>
+#include <array>
+#include <chrono>
 
 namespace this_file
 {
@@ -35,6 +37,16 @@ namespace this_file
 
         natus::ntd::vector< natus::device::imapping_res_t > _mappings ;
 
+        // the update loop runs every millisecond. Repeated states
+        // are collapsed and stick values are only logged periodically.
+        using button_cycles_t = std::array< size_t,
+            size_t( natus::device::layouts::game_controller_t::button::num_buttons ) > ;
+        button_cycles_t _pressing_cycles = button_cycles_t() ;
+
+        using log_clock_t = std::chrono::high_resolution_clock ;
+        std::chrono::milliseconds const _stick_log_interval = std::chrono::milliseconds( 100 ) ;
+        log_clock_t::time_point _stick_logged ;
+
     public:
 
         test_app( void_t ) 
@@ -48,6 +60,8 @@ namespace this_file
             _wid_async = ::std::move( rhv._wid_async ) ;
             _game_dev = ::std::move( rhv._game_dev ) ;
             _mappings = ::std::move( rhv._mappings ) ;
+            _pressing_cycles = rhv._pressing_cycles ;
+            _stick_logged = rhv._stick_logged ;
         }
         virtual ~test_app( void_t ) 
         {}
@@ -115,7 +129,7 @@ namespace this_file
                     natus::log::global_t::warning( natus::core::is_not( res ), "can not do mapping." ) ;
                 }
 
-                _mappings.emplace_back( natus::memory::res_t<mapping_t>(m) ) ;
+                _mappings.emplace_back( natus::memory::res_t<mapping_t>( std::move( m ) ) ) ;
             }
 
             // do mappings for ascii
@@ -164,7 +178,7 @@ namespace this_file
                 }
                 
 
-                _mappings.emplace_back( natus::memory::res_t<mapping_t>( m ) ) ;
+                _mappings.emplace_back( natus::memory::res_t<mapping_t>( std::move( m ) ) ) ;
             }
 
             // do mappings for mouse
@@ -183,7 +197,7 @@ namespace this_file
                     natus::log::global_t::warning( natus::core::is_not( res ), "can not do mapping." ) ;
                 }
 
-                _mappings.emplace_back( natus::memory::res_t<mapping_t>( m ) ) ;
+                _mappings.emplace_back( natus::memory::res_t<mapping_t>( std::move( m ) ) ) ;
             }
 
             return natus::application::result::ok ; 
@@ -194,21 +208,29 @@ namespace this_file
             using ctrl_t = natus::device::layouts::game_controller_t ;
             ctrl_t ctrl( _game_dev ) ;
 
+            size_t & cycles = _pressing_cycles[ size_t( btn ) ] ;
+
             float_t value = 0.0f ;
             if( ctrl.is( btn, natus::device::components::button_state::pressed, value ) )
             {
+                cycles = 0 ;
                 natus::log::global_t::status( "pressed: " + ctrl_t::to_string( btn ) +
                     " [" + ::std::to_string( value ) + "]" ) ;
             }
             else if( ctrl.is( btn, natus::device::components::button_state::pressing, value ) )
             {
+                // only the first pressing cycle is logged
+                if( cycles++ != 0 ) return ;
+
                 natus::log::global_t::status( "pressing: " + ctrl_t::to_string( btn ) +
                     " [" + ::std::to_string( value ) + "]" ) ;
             }
             else if( ctrl.is( btn, natus::device::components::button_state::released, value ) )
             {
                 natus::log::global_t::status( "released: " + ctrl_t::to_string( btn ) +
-                    " [" + ::std::to_string( value ) + "]" ) ;
+                    " [" + ::std::to_string( value ) + "]" +
+                    ( cycles > 1 ? " (pressing repeated " + ::std::to_string( cycles - 1 ) + " times)" : "" ) ) ;
+                cycles = 0 ;
             }
         }
 
@@ -227,6 +249,13 @@ namespace this_file
 
             ctrl_t ctrl( _game_dev ) ;
 
+            // rate limit the stick logs
+            {
+                auto const now = log_clock_t::now() ;
+                if( now - _stick_logged < _stick_log_interval ) return ;
+                _stick_logged = now ;
+            }
+
             natus::math::vec2f_t value ;
             if( ctrl.is( ctrl_t::directional::aim, natus::device::components::stick_state::tilting, value ) )
             {
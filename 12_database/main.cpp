@@ -16,25 +16,27 @@ int main( int argc, char ** argv )
 
     natus::io::database db( natus::io::path_t( DATAPATH ), "./working", "data" ) ;
 
+    // all loads are issued first. The results are waited for
+    // afterwards, in the order the loads were issued.
     {
-        db.load( natus::io::location_t( "images.checker.png" ) ).wait_for_operation( [&] ( char_cptr_t data, size_t const sib ) 
+        auto lh_image = db.load( natus::io::location_t( "images.checker.png" ) ) ;
+        auto lh_info = db.load( natus::io::location_t( "some_info.txt" ) ) ;
+        auto lh_mesh = db.load( natus::io::location_t( "meshes.text.obj" ) ) ;
+
+        lh_image.wait_for_operation( [&] ( char_cptr_t data, size_t const sib )
         { 
 
             natus::log::global_t::status( "********************************" ) ;
             natus::log::global_t::status( "loaded images.checker with " + ::std::to_string(sib) + " bytes" ) ;
         } ) ;
-    }
 
-    {
-        db.load( natus::io::location_t( "some_info.txt" ) ).wait_for_operation( [&] ( char_cptr_t data, size_t const sib )
+        lh_info.wait_for_operation( [&] ( char_cptr_t data, size_t const sib )
         {
             natus::log::global_t::status( "********************************" ) ;
             natus::log::global_t::status( natus::ntd::string_t( data, sib ) ) ;
         } ) ;
-    }
 
-    {
-        db.load( natus::io::location_t( "meshes.text.obj" ) ).wait_for_operation( [&] ( char_cptr_t data, size_t const sib )
+        lh_mesh.wait_for_operation( [&] ( char_cptr_t data, size_t const sib )
         {
             natus::log::global_t::status( "********************************" ) ;
             natus::log::global_t::status( natus::ntd::string_t( data, sib ) ) ;
@@ -8,6 +8,7 @@
 
 #include <natus/format/global.h>
 #include <natus/format/nsl/nsl_module.h>
+#include <natus/format/future_items.hpp>
 
 #include <natus/io/database.h>
 #include <natus/log/global.h>
@@ -69,13 +70,21 @@ int main( int argc, char ** argv )
 
     natus::ntd::vector< natus::nsl::symbol_t > config_symbols ;
 
-    for( auto const& l : shader_locations )
+    // issue all imports, then collect them in order.
     {
         natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-        auto fitem2 = mod_reg->import_from( l, db ) ;
 
-        natus::format::nsl_item_res_t ii = fitem2.get() ;
-        if( ii.is_valid() ) ndb->insert( std::move( std::move( ii->doc ) ), config_symbols ) ;
+        natus::ntd::vector< natus::format::future_item_t > futures ;
+        for( auto const& l : shader_locations )
+        {
+            futures.emplace_back( mod_reg->import_from( l, db ) ) ;
+        }
+
+        for( auto & f : futures )
+        {
+            natus::format::nsl_item_res_t ii = f.get() ;
+            if( ii.is_valid() ) ndb->insert( std::move( std::move( ii->doc ) ), config_symbols ) ;
+        }
     }
     
     for( auto const & c : config_symbols )
@@ -55,6 +55,10 @@ namespace this_file
         natus::ntd::vector< float_t > _frequencies1 ;
         natus::ntd::vector< float_t > _freq_bands ;
 
+        // per frame scratch memory of the tool.
+        // it keeps its capacity, so it is only allocated once.
+        natus::ntd::vector< float_t > _difs ;
+
     public:
 
         test_app( void_t )
@@ -80,6 +84,7 @@ namespace this_file
 
             _frequencies0 = std::move( rhv._frequencies0 ) ;
             _freq_bands = std::move( rhv._freq_bands ) ;
+            _difs = std::move( rhv._difs ) ;
         }
         virtual ~test_app( void_t )
         {
@@ -221,7 +226,9 @@ namespace this_file
 
             // tried some sort of peaking, but sucks.
             {
-                natus::ntd::vector< float_t > difs( _frequencies0.size() ) ;
+                _difs.resize( _frequencies0.size() ) ;
+                auto & difs = _difs ;
+
                 for( size_t i = 0; i < _frequencies0.size(); ++i )
                 {
                     difs[ i ] = _frequencies0[ i ] - _frequencies1[ i ] ;
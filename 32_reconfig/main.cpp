@@ -32,6 +32,7 @@
 #include <natus/math/utility/3d/transformation.hpp>
 
 #include <thread>
+#include <mutex>
 
 namespace this_file
 {
@@ -77,6 +78,13 @@ namespace this_file
 
         natus::math::vec4ui_t _fb_dims = natus::math::vec4ui_t( 0, 0, 1280, 768 ) ;
 
+        // imported images are cached by location and shared through
+        // their res handle. An entry is dropped if the monitor reports
+        // a change of the file.
+        std::mutex _mtx_images ;
+        natus::ntd::map< natus::ntd::string_t, natus::graphics::image_object_res_t > _images ;
+        natus::io::monitor_res_t _image_mon = natus::io::monitor_t() ;
+
     public:
 
         test_app( void_t ) 
@@ -111,10 +119,48 @@ namespace this_file
             _rc_map = std::move( rhv._rc_map ) ;
             _ndb = std::move( rhv._ndb ) ;
             _db = std::move( rhv._db ) ;
+            _images = std::move( rhv._images ) ;
+            _image_mon = std::move( rhv._image_mon ) ;
         }
         virtual ~test_app( void_t ) 
         {}
 
+    private:
+
+        natus::graphics::image_object_res_t load_image( natus::io::location_cref_t loc ) noexcept
+        {
+            std::lock_guard< std::mutex > lk( _mtx_images ) ;
+
+            _image_mon->for_each_and_swap( [&] ( natus::io::location_cref_t l, natus::io::monitor_t::notify const )
+            {
+                _images.erase( l.as_string() ) ;
+            } ) ;
+
+            {
+                auto const iter = _images.find( loc.as_string() ) ;
+                if( iter != _images.end() ) return iter->second ;
+            }
+
+            natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
+            auto fitem = mod_reg->import_from( loc, _db ) ;
+            natus::format::image_item_res_t ii = fitem.get() ;
+            if( !ii.is_valid() ) return natus::graphics::image_object_res_t() ;
+
+            natus::graphics::image_t img = *ii->img ;
+
+            natus::graphics::image_object_res_t ret = natus::graphics::image_object_t( "loaded_image", std::move( img ) )
+                .set_wrap( natus::graphics::texture_wrap_mode::wrap_s, natus::graphics::texture_wrap_type::repeat )
+                .set_wrap( natus::graphics::texture_wrap_mode::wrap_t, natus::graphics::texture_wrap_type::repeat )
+                .set_filter( natus::graphics::texture_filter_mode::min_filter, natus::graphics::texture_filter_type::nearest )
+                .set_filter( natus::graphics::texture_filter_mode::mag_filter, natus::graphics::texture_filter_type::nearest );
+
+            _images[ loc.as_string() ] = ret ;
+
+            return ret ;
+        }
+
+    public:
+
         virtual natus::application::result on_event( window_id_t const, this_t::window_event_info_in_t wei ) noexcept
         {
             _camera_0.perspective_fov( natus::math::angle<float_t>::degree_to_radian( 90.0f ),
@@ -271,19 +317,11 @@ namespace this_file
 
             // image configuration
             {
-                natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                auto fitem = mod_reg->import_from( natus::io::location_t( "images.checker.png" ), _db ) ;
-                natus::format::image_item_res_t ii = fitem.get() ;
-                if( ii.is_valid() )
-                {
-                    natus::graphics::image_t img = *ii->img ;
+                _db->attach( "images.checker.png", _image_mon ) ;
+                _db->attach( "images.test.png", _image_mon ) ;
 
-                    _imgconfig = natus::graphics::image_object_t( "loaded_image", std::move( img ) )
-                        .set_wrap( natus::graphics::texture_wrap_mode::wrap_s, natus::graphics::texture_wrap_type::repeat )
-                        .set_wrap( natus::graphics::texture_wrap_mode::wrap_t, natus::graphics::texture_wrap_type::repeat )
-                        .set_filter( natus::graphics::texture_filter_mode::min_filter, natus::graphics::texture_filter_type::nearest )
-                        .set_filter( natus::graphics::texture_filter_mode::mag_filter, natus::graphics::texture_filter_type::nearest );
-                }
+                auto img = this_t::load_image( natus::io::location_t( "images.checker.png" ) ) ;
+                if( img.is_valid() ) _imgconfig = img ;
 
                 _wid_async.async().configure( _imgconfig ) ;
                 _wid_async2.async().configure( _imgconfig ) ;
@@ -637,20 +675,9 @@ namespace this_file
                 {
                     // image configuration
                     {
-                        natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                        auto fitem = mod_reg->import_from( natus::io::location_t( "images.test.png" ), _db ) ;
-                        natus::format::image_item_res_t ii = fitem.get() ;
-                        if( ii.is_valid() )
+                        natus::graphics::image_object_res_t _img_ = this_t::load_image( natus::io::location_t( "images.test.png" ) ) ;
+                        if( _img_.is_valid() )
                         {
-                            natus::graphics::image_t img = *ii->img ;
-
-                            natus::graphics::image_object_res_t _img_ = natus::graphics::image_object_t( "loaded_image", std::move( img ) )
-                                .set_wrap( natus::graphics::texture_wrap_mode::wrap_s, natus::graphics::texture_wrap_type::repeat )
-                                .set_wrap( natus::graphics::texture_wrap_mode::wrap_t, natus::graphics::texture_wrap_type::repeat )
-                                .set_filter( natus::graphics::texture_filter_mode::min_filter, natus::graphics::texture_filter_type::nearest )
-                                .set_filter( natus::graphics::texture_filter_mode::mag_filter, natus::graphics::texture_filter_type::nearest );
-
-
                             _wid_async.async().configure( _img_ ) ;
                             _wid_async2.async().configure( _img_ ) ;
                         }
@@ -660,20 +687,9 @@ namespace this_file
 
                     // image configuration 
                     {
-                        natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                        auto fitem = mod_reg->import_from( natus::io::location_t( "images.checker.png" ), _db ) ;
-                        natus::format::image_item_res_t ii = fitem.get() ;
-                        if( ii.is_valid() )
+                        natus::graphics::image_object_res_t _img_ = this_t::load_image( natus::io::location_t( "images.checker.png" ) ) ;
+                        if( _img_.is_valid() )
                         {
-                            natus::graphics::image_t img = *ii->img ;
-
-                            natus::graphics::image_object_res_t _img_ = natus::graphics::image_object_t( "loaded_image", std::move( img ) )
-                                .set_wrap( natus::graphics::texture_wrap_mode::wrap_s, natus::graphics::texture_wrap_type::repeat )
-                                .set_wrap( natus::graphics::texture_wrap_mode::wrap_t, natus::graphics::texture_wrap_type::repeat )
-                                .set_filter( natus::graphics::texture_filter_mode::min_filter, natus::graphics::texture_filter_type::nearest )
-                                .set_filter( natus::graphics::texture_filter_mode::mag_filter, natus::graphics::texture_filter_type::nearest );
-
-
                             _wid_async.async().configure( _img_ ) ;
                             _wid_async2.async().configure( _img_ ) ;
                         }
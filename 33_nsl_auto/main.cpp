@@ -32,6 +32,7 @@
 #include <natus/math/utility/3d/transformation.hpp>
 
 #include <thread>
+#include <algorithm>
 
 namespace this_file
 {
@@ -316,15 +317,22 @@ namespace this_file
 
                 natus::ntd::vector< natus::nsl::symbol_t > config_symbols ;
 
-                for( auto const & l : shader_locations )
+                // issue all imports, then collect them in order.
+                natus::ntd::vector< natus::format::future_item_t > futures ;
                 {
                     natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                    auto fitem2 = mod_reg->import_from( l, _db ) ;
+                    for( auto const & l : shader_locations )
+                    {
+                        futures.emplace_back( mod_reg->import_from( l, _db ) ) ;
+                    }
+                }
 
-                    natus::format::nsl_item_res_t ii = fitem2.get() ;
+                for( size_t i=0; i<shader_locations.size(); ++i )
+                {
+                    natus::format::nsl_item_res_t ii = futures[i].get() ;
                     if( ii.is_valid() ) _ndb->insert( std::move( std::move( ii->doc ) ), config_symbols ) ;
 
-                    _db->attach( l.as_string(), _shader_mon ) ;
+                    _db->attach( shader_locations[i].as_string(), _shader_mon ) ;
                 }
 
                 // generate configs
@@ -487,16 +495,33 @@ namespace this_file
             // check file changes
             // and recompile and set new shaders
             {
+                // the notifications are collected per location first, so a
+                // file that is reported more than once in a swap is still
+                // only re-imported once.
+                natus::ntd::vector< natus::io::location_t > changed ;
                 _shader_mon->for_each_and_swap( [&] ( natus::io::location_cref_t loc, natus::io::monitor_t::notify const )
                 {
-                    natus::nsl::database_t::symbols_t config_symbols ;
-
-                    natus::log::global_t::status( "File changed: " + loc.as_string() ) ;
+                    auto const iter = std::find( changed.begin(), changed.end(), loc ) ;
+                    if( iter == changed.end() ) changed.emplace_back( loc ) ;
+                } ) ;
 
+                // only the changed files are re-imported.
+                natus::ntd::vector< natus::format::future_item_t > futures ;
+                if( changed.size() != 0 )
+                {
                     natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                    auto fitem2 = mod_reg->import_from( loc, _db ) ;
+                    for( auto const & loc : changed )
+                    {
+                        natus::log::global_t::status( "File changed: " + loc.as_string() ) ;
+                        futures.emplace_back( mod_reg->import_from( loc, _db ) ) ;
+                    }
+                }
+
+                for( auto & f : futures )
+                {
+                    natus::nsl::database_t::symbols_t config_symbols ;
 
-                    natus::format::nsl_item_res_t ii = fitem2.get() ;
+                    natus::format::nsl_item_res_t ii = f.get() ;
                     if( ii.is_valid() ) _ndb->insert( std::move( std::move( ii->doc ) ), config_symbols ) ;
 
                     for( auto const & s : config_symbols )
@@ -521,7 +546,7 @@ namespace this_file
                             a.configure( sc ) ;
                         } ) ;
                     }
-                } ) ;
+                }
             }
 
             auto const dif = std::chrono::duration_cast< std::chrono::microseconds >( __clock_t::now() - _tp ) ;
@@ -158,6 +158,22 @@ namespace this_file
                 natus::log::global_t::status( "no ascii keyboard found" ) ;
             }
 
+            // the shaders are not needed before the glyph atlas is done.
+            // their imports are issued here and collected after it.
+            natus::ntd::vector< natus::io::location_t > shader_locations = {
+                natus::io::location_t( "shaders.map_glyph_atlas.nsl" ),
+                natus::io::location_t( "shaders.post_blit.nsl" )
+            };
+
+            natus::ntd::vector< natus::format::future_item_t > shader_futures ;
+            {
+                natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
+                for( auto const & l : shader_locations )
+                {
+                    shader_futures.emplace_back( mod_reg->import_from( l, _db ) ) ;
+                }
+            }
+
             {
                 _camera_0.look_at( natus::math::vec3f_t( 0.0f, 60.0f, -50.0f ),
                         natus::math::vec3f_t( 0.0f, 1.0f, 0.0f ), natus::math::vec3f_t( 0.0f, 0.0f, 0.0f )) ;
@@ -303,15 +319,14 @@ namespace this_file
                         typedef natus::math::vector4< uint8_t > rgba_t ;
                         auto* data_ = reinterpret_cast< rgba_t* >( data_in ) ;
 
-                        auto* raw = ga.get_image( 0 ) ;
-                        for( size_t y = 0; y < dims.y(); ++y )
+                        // the atlas plane and the image are both tightly packed,
+                        // so one linear pass without per pixel indexing
+                        // is enough and can be vectorized by the compiler.
+                        auto const & plane = ga.get_image( 0 )->get_plane() ;
+                        size_t const n = size_t( dims.x() ) * size_t( dims.y() ) ;
+                        for( size_t i = 0; i < n; ++i )
                         {
-                            for( size_t x = 0; x < dims.x() ; ++x )
-                            {
-                                *data_ = rgba_t( 0 ) ;
-                                size_t idx = y * dims.y() + x ;
-                                data_[ idx ][ 0 ] = raw->get_plane()[ idx ] ;
-                            }
+                            data_[ i ] = rgba_t( plane[ i ], 0, 0, 0 ) ;
                         }
                     } ) ;
 
@@ -329,22 +344,14 @@ namespace this_file
             }
             // load
             {
-                natus::ntd::vector< natus::io::location_t > shader_locations = {
-                    natus::io::location_t( "shaders.map_glyph_atlas.nsl" ),
-                    natus::io::location_t( "shaders.post_blit.nsl" )
-                };
-
                 natus::ntd::vector< natus::nsl::symbol_t > config_symbols ;
 
-                for( auto const & l : shader_locations )
+                for( size_t i=0; i<shader_locations.size(); ++i )
                 {
-                    natus::format::module_registry_res_t mod_reg = natus::format::global_t::registry() ;
-                    auto fitem2 = mod_reg->import_from( l, _db ) ;
-
-                    natus::format::nsl_item_res_t ii = fitem2.get() ;
+                    natus::format::nsl_item_res_t ii = shader_futures[i].get() ;
                     if( ii.is_valid() ) _ndb->insert( std::move( std::move( ii->doc ) ), config_symbols ) ;
 
-                    _db->attach( l.as_string(), _shader_mon ) ;
+                    _db->attach( shader_locations[i].as_string(), _shader_mon ) ;
                 }
 
                 // generate configs
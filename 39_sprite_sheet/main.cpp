@@ -28,6 +28,7 @@
 #include <natus/math/utility/3d/transformation.hpp>
 
 #include <thread>
+#include <algorithm>
 
 namespace this_file
 {
@@ -253,6 +254,17 @@ namespace this_file
                             }
 
 
+                            // sprite name to index table. It is built once per sheet,
+                            // so animation frames are resolved by a binary search.
+                            typedef std::pair< natus::ntd::string_t, size_t > sprite_id_t ;
+                            natus::ntd::vector< sprite_id_t > sprite_ids ;
+                            sprite_ids.reserve( ss.sprites.size() ) ;
+                            for( size_t si=0; si<ss.sprites.size(); ++si )
+                            {
+                                sprite_ids.emplace_back( ss.sprites[si].name, si ) ;
+                            }
+                            std::sort( sprite_ids.begin(), sprite_ids.end() ) ;
+
                             for( auto const & a : ss.animations )
                             {
                                 sprite_sheet::animation a_ ;
@@ -260,13 +272,14 @@ namespace this_file
                                 size_t tp = 0 ;
                                 for( auto const & f : a.frames )
                                 {
-                                    auto iter = std::find_if( ss.sprites.begin(), ss.sprites.end(), 
-                                        [&]( natus::format::natus_document_t::sprite_sheet_t::sprite_cref_t s )
+                                    auto const iter = std::lower_bound( sprite_ids.begin(), sprite_ids.end(), f.sprite,
+                                        [&]( sprite_id_t const & si, natus::ntd::string_cref_t name )
                                     {
-                                        return s.name == f.sprite ;
+                                        return si.first < name ;
                                     } ) ;
 
-                                    size_t const d = std::distance( ss.sprites.begin(), iter ) ;
+                                    size_t const d = iter != sprite_ids.end() && iter->first == f.sprite ?
+                                        iter->second : ss.sprites.size() ;
                                     sprite_sheet::animation::sprite s_ ;
                                     s_.begin = tp ;
                                     s_.end = tp + f.duration ;
@@ -31,6 +31,8 @@
 #include <natus/math/utility/3d/transformation.hpp>
 
 #include <thread>
+#include <algorithm>
+#include <atomic>
 
 namespace this_file
 {
@@ -60,7 +62,10 @@ namespace this_file
         
         natus::ntd::vector< natus::gfx::sprite_sheet_t > _sheets ;
 
-        
+        // the clocks only store their raw timings.
+        // formatting is done in the tool window.
+        std::atomic< size_t > _physics_micro_dt { 0 } ;
+        std::atomic< size_t > _graphics_micro_dt { 0 } ;
 
     public:
 
@@ -199,18 +204,37 @@ namespace this_file
                     natus::graphics::image_t imgs ;
 
                     // load images
+                    // sheets can share an image. Every distinct image
+                    // is only imported once and used for all its sheets.
                     {
+                        natus::ntd::vector< natus::ntd::string_t > srcs ;
+                        natus::ntd::vector< size_t > import_ids ;
                         natus::ntd::vector< natus::format::future_item_t > futures ;
+
                         for( auto const & ss : doc.sprite_sheets )
                         {
+                            auto const iter = std::find( srcs.begin(), srcs.end(), ss.image.src ) ;
+                            if( iter != srcs.end() )
+                            {
+                                import_ids.emplace_back( std::distance( srcs.begin(), iter ) ) ;
+                                continue ;
+                            }
+
                             auto const l = natus::io::location_t::from_path( natus::io::path_t(ss.image.src) ) ;
+                            import_ids.emplace_back( futures.size() ) ;
+                            srcs.emplace_back( ss.image.src ) ;
                             futures.emplace_back( mod_reg->import_from( l, _db ) ) ;
                         }
 
+                        natus::ntd::vector< natus::format::image_item_res_t > items ;
+                        for( auto & f : futures )
+                        {
+                            items.emplace_back( f.get() ) ;
+                        }
                     
                         for( size_t i=0; i<doc.sprite_sheets.size(); ++i )
                         {
-                            natus::format::image_item_res_t ii = futures[i].get() ;
+                            natus::format::image_item_res_t ii = items[ import_ids[i] ] ;
                             if( ii.is_valid() )
                             {
                                 imgs.append( *ii->img ) ;
@@ -250,16 +274,37 @@ namespace this_file
                                 sheet.rects.emplace_back( s_ ) ;
                             }
 
-                            natus::ntd::map< natus::ntd::string_t, size_t > object_map ;
+                            // sprite name to index table. It is built once per sheet,
+                            // so animation frames are resolved by a binary search.
+                            typedef std::pair< natus::ntd::string_t, size_t > sprite_id_t ;
+                            natus::ntd::vector< sprite_id_t > sprite_ids ;
+                            sprite_ids.reserve( ss.sprites.size() ) ;
+                            for( size_t si=0; si<ss.sprites.size(); ++si )
+                            {
+                                sprite_ids.emplace_back( ss.sprites[si].name, si ) ;
+                            }
+                            std::sort( sprite_ids.begin(), sprite_ids.end() ) ;
+
+                            // a sheet only has a few objects, so a flat array
+                            // is used for the name lookup. No node per object.
+                            natus::ntd::vector< std::pair< natus::ntd::string_t, size_t > > object_map ;
+                            object_map.reserve( ss.animations.size() ) ;
+
                             for( auto const & a : ss.animations )
                             {
                                 size_t obj_id = 0 ;
                                 {
-                                    auto iter = object_map.find( a.object ) ;
+                                    auto iter = std::find_if( object_map.begin(), object_map.end(),
+                                        [&]( std::pair< natus::ntd::string_t, size_t > const & o )
+                                    {
+                                        return o.first == a.object ;
+                                    } ) ;
+
                                     if( iter != object_map.end() ) obj_id = iter->second ;
                                     else 
                                     {
                                         obj_id = sheet.objects.size() ;
+                                        object_map.emplace_back( a.object, obj_id ) ;
                                         sheet.objects.emplace_back( natus::gfx::sprite_sheet::object { a.object, {} } ) ;
                                     }
                                 }
@@ -269,13 +314,14 @@ namespace this_file
                                 size_t tp = 0 ;
                                 for( auto const & f : a.frames )
                                 {
-                                    auto iter = std::find_if( ss.sprites.begin(), ss.sprites.end(), 
-                                        [&]( natus::format::natus_document_t::sprite_sheet_t::sprite_cref_t s )
+                                    auto const iter = std::lower_bound( sprite_ids.begin(), sprite_ids.end(), f.sprite,
+                                        [&]( sprite_id_t const & si, natus::ntd::string_cref_t name )
                                     {
-                                        return s.name == f.sprite ;
+                                        return si.first < name ;
                                     } ) ;
 
-                                    size_t const d = std::distance( ss.sprites.begin(), iter ) ;
+                                    size_t const d = iter != sprite_ids.end() && iter->first == f.sprite ?
+                                        iter->second : ss.sprites.size() ;
                                     natus::gfx::sprite_sheet::animation::sprite s_ ;
                                     s_.begin = tp ;
                                     s_.end = tp + f.duration ;
@@ -367,7 +413,7 @@ namespace this_file
 
         virtual natus::application::result on_physics( natus::application::app_t::physics_data_in_t pd ) noexcept
         { 
-            natus::log::global_t::status( "physics: " + std::to_string( pd.micro_dt ) ) ;
+            _physics_micro_dt = pd.micro_dt ;
 
             static float_t inter = 0.0f ;
             float_t v = natus::math::interpolation<float_t>::linear( 0.0f, 1.0f, inter ) *2.0f-1.0f ;
@@ -389,7 +435,7 @@ namespace this_file
 
         virtual natus::application::result on_graphics( natus::application::app_t::render_data_in_t rdi ) noexcept 
         { 
-            natus::log::global_t::status( "graphics: " + std::to_string( rdi.micro_dt ) ) ;
+            _graphics_micro_dt = rdi.micro_dt ;
             _sr->set_view_proj( _camera_0.mat_view(), _camera_0.mat_proj() ) ;
 
             size_t const sheet = 0 ;
@@ -509,6 +555,9 @@ namespace this_file
 
             ImGui::Begin( "do something" ) ;
 
+            ImGui::Text( "physics: %zu [micro]", size_t( _physics_micro_dt ) ) ;
+            ImGui::Text( "graphics: %zu [micro]", size_t( _graphics_micro_dt ) ) ;
+
             ImGui::End() ;
             return natus::application::result::ok ;
         }
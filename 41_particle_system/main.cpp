@@ -796,7 +796,7 @@ namespace nps
 
     public:
 
-        void_t attach_emitter( emitter_res_t emt ) noexcept
+        void_t attach_emitter( emitter_res_cref_t emt ) noexcept
         {
             auto iter = std::find_if( _emitter.begin(), _emitter.end(), [&]( emitter_data_cref_t d )
             {
@@ -807,7 +807,7 @@ namespace nps
             _emitter.push_back( { emt, 0, 0, 0 } ) ;
         }
 
-        void_t detach_emitter( emitter_res_t emt ) noexcept
+        void_t detach_emitter( emitter_res_cref_t emt ) noexcept
         {
             auto iter = std::find_if( _emitter.begin(), _emitter.end(), [&]( emitter_data_cref_t d )
             {
@@ -818,7 +818,7 @@ namespace nps
             _emitter.erase( iter ) ;
         }
 
-        void_t attach_force_field( force_field_res_t ff ) noexcept
+        void_t attach_force_field( force_field_res_cref_t ff ) noexcept
         {
             auto iter = std::find_if( _forces.begin(), _forces.end(), [&]( force_field_data_cref_t d )
             {
@@ -828,7 +828,7 @@ namespace nps
             _forces.push_back( { ff } ) ;
         }
 
-        void_t detach_force_field( force_field_res_t ff ) noexcept
+        void_t detach_force_field( force_field_res_cref_t ff ) noexcept
         {
             auto iter = std::find_if( _forces.begin(), _forces.end(), [&]( force_field_data_cref_t d )
             {
@@ -1053,7 +1053,7 @@ namespace nps
             flakes.update( dt ) ;
         }
 
-        void_t render( natus::gfx::primitive_render_2d_res_t pr )
+        void_t render( natus::gfx::primitive_render_2d_res_cref_t pr )
         {
             flakes.on_particles( [&]( natus::ntd::vector< particle_t > const & particles )
             {
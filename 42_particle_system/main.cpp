@@ -114,7 +114,7 @@ namespace this_file
             flakes.update( dt ) ;
         }
 
-        void_t render( natus::gfx::primitive_render_2d_res_t pr )
+        void_t render( natus::gfx::primitive_render_2d_res_cref_t pr )
         {
             flakes.on_particles( [&]( natus::ntd::vector< natus::physics::particle_t > const & particles )
             {